@@ -109,6 +109,19 @@ public:
       EXPECT_EQ(unit, presentationMessage.presentationunitstring());
    }
 
+   int GetPlatformParameterKey(const char* group, const char* parameter) const
+   {
+      if(DocumentationPlatformDetector::EINSTEIN_COMBINE_PLATFORM == Params.PlatformType)
+      {
+         return PlatformSpecificParameterHelper::GetEinsteinParameterKey(group, parameter).toInt();
+      }
+      else if(DocumentationPlatformDetector::GRIZZLY_COMBINE_PLATFORM == Params.PlatformType)
+      {
+         return PlatformSpecificParameterHelper::GetGrizzlyParameterKey(group, parameter).toInt();
+      }
+      return PlatformSpecificParameterHelper::GetMagmaParameterKey(group, parameter).toInt();
+   }
+
    void Initialize(const QString& parameter, const InfoBusValueProviderCallback& callback)
    {
       QString keyStr(QString("%1.%2").arg(INSTANT_PREFIX).arg(parameter));
@@ -117,19 +130,7 @@ public:
 
    void InstantaneousFuelPerAreaInputProcess(const JDNumber& implementWidth, const JDNumber& fuelRate, const JDNumber& deltaDistance,  JDDocumentationPresentationMessage& presentationMessage, const bool& isRecordingOn = true)
    {
-      int instantaneousFuelPerAreaKey;
-      if(DocumentationPlatformDetector::EINSTEIN_COMBINE_PLATFORM == Params.PlatformType)
-      {
-         instantaneousFuelPerAreaKey = PlatformSpecificParameterHelper::GetEinsteinParameterKey("InstantCalculators", "InstantaneousFuelPerArea").toInt();
-      }
-      else if(DocumentationPlatformDetector::GRIZZLY_COMBINE_PLATFORM == Params.PlatformType)
-      {
-         instantaneousFuelPerAreaKey = PlatformSpecificParameterHelper::GetGrizzlyParameterKey("InstantCalculators", "InstantaneousFuelPerArea").toInt();
-      }
-      else
-      {
-         instantaneousFuelPerAreaKey = PlatformSpecificParameterHelper::GetMagmaParameterKey("InstantCalculators", "InstantaneousFuelPerArea").toInt();
-      }
+      int instantaneousFuelPerAreaKey = GetPlatformParameterKey("InstantCalculators", "InstantaneousFuelPerArea");
       FuelPerArea* fuelPerArea = dynamic_cast<FuelPerArea*>(BasicDocumentationService->GetInstantCalculatorPool(instantaneousFuelPerAreaKey));
       ASSERT_THAT(fuelPerArea, NotNull());
 
@@ -145,19 +146,7 @@ public:
 
    void TimeTillEmptyInputProcess(const JDNumber& engineFuelTankCapacity, const JDNumber& fuelRate, const JDNumber& fuelTankLevel, const JDNumber& engineSpeed, JDDocumentationPresentationMessage& presentationMessage)
    {
-      int timeTillEmptyKey;
-      if(DocumentationPlatformDetector::EINSTEIN_COMBINE_PLATFORM == Params.PlatformType)
-      {
-         timeTillEmptyKey = PlatformSpecificParameterHelper::GetEinsteinParameterKey("InstantCalculators", "TimeToEmpty").toInt();
-      }
-      else if(DocumentationPlatformDetector::GRIZZLY_COMBINE_PLATFORM == Params.PlatformType)
-      {
-         timeTillEmptyKey = PlatformSpecificParameterHelper::GetGrizzlyParameterKey("InstantCalculators", "TimeToEmpty").toInt();
-      }
-      else
-      {
-         timeTillEmptyKey = PlatformSpecificParameterHelper::GetMagmaParameterKey("InstantCalculators", "TimeToEmpty").toInt();
-      }
+      int timeTillEmptyKey = GetPlatformParameterKey("InstantCalculators", "TimeToEmpty");
       TimeTillEmpty* timeTillEmpty = dynamic_cast<TimeTillEmpty*>(BasicDocumentationService->GetInstantCalculatorPool(timeTillEmptyKey));
       ASSERT_THAT(timeTillEmpty, NotNull());
 
@@ -220,19 +209,7 @@ public:
 
       EXPECT_CALL(*DocumentationTestHarnessInstance.GetSpeedProviderServiceProxy(), GetWheelSpeed()).WillRepeatedly(ReturnRef(speed));
 
-      int wheelSpeedKey;
-      if(DocumentationPlatformDetector::EINSTEIN_COMBINE_PLATFORM == Params.PlatformType)
-      {
-         wheelSpeedKey = PlatformSpecificParameterHelper::GetEinsteinParameterKey("Aggregators", "WheelSpeed").toInt();
-      }
-      else if(DocumentationPlatformDetector::GRIZZLY_COMBINE_PLATFORM == Params.PlatformType)
-      {
-         wheelSpeedKey = PlatformSpecificParameterHelper::GetGrizzlyParameterKey("Aggregators", "WheelSpeed").toInt();
-      }
-      else
-      {
-         wheelSpeedKey = PlatformSpecificParameterHelper::GetMagmaParameterKey("Aggregators", "WheelSpeed").toInt();
-      }
+      int wheelSpeedKey = GetPlatformParameterKey("Aggregators", "WheelSpeed");
       TECUWheelSpeed* wheelSpeed = dynamic_cast<TECUWheelSpeed*>(BasicDocumentationService->GetAggregatorPool(wheelSpeedKey));
 
       ASSERT_THAT(wheelSpeed, NotNull());
@@ -254,23 +231,8 @@ public:
 
       EXPECT_CALL(*DocumentationTestHarnessInstance.GetSpeedProviderServiceProxy(), GetGPSSpeed()).WillRepeatedly(ReturnRef(speed));
 
-      int gpsSpeedKey;
-      int gpsPresentationKey;
-      if(DocumentationPlatformDetector::EINSTEIN_COMBINE_PLATFORM == Params.PlatformType)
-      {
-         gpsSpeedKey = PlatformSpecificParameterHelper::GetEinsteinParameterKey("Aggregators", "GPSSpeed").toInt();
-         gpsPresentationKey = PlatformSpecificParameterHelper::GetEinsteinParameterKey("InstantCalculators", "GPSPresentation").toInt();
-      }
-      else if(DocumentationPlatformDetector::GRIZZLY_COMBINE_PLATFORM == Params.PlatformType)
-      {
-          gpsSpeedKey = PlatformSpecificParameterHelper::GetGrizzlyParameterKey("Aggregators", "GPSSpeed").toInt();
-          gpsPresentationKey = PlatformSpecificParameterHelper::GetGrizzlyParameterKey("InstantCalculators", "GPSPresentation").toInt();
-      }
-      else
-      {
-         gpsSpeedKey = PlatformSpecificParameterHelper::GetMagmaParameterKey("Aggregators", "GPSSpeed").toInt();
-         gpsPresentationKey = PlatformSpecificParameterHelper::GetMagmaParameterKey("InstantCalculators", "GPSPresentation").toInt();
-      }
+      int gpsSpeedKey = GetPlatformParameterKey("Aggregators", "GPSSpeed");
+      int gpsPresentationKey = GetPlatformParameterKey("InstantCalculators", "GPSPresentation");
       GPSSpeed* gpsSpeed = dynamic_cast<GPSSpeed*>(BasicDocumentationService->GetAggregatorPool(gpsSpeedKey));
 
       ASSERT_THAT(gpsSpeed, NotNull());